@@ -8,7 +8,7 @@ ifeq "$(strip ${TARGET_DIR})" ""
 endif
 
 TARGET   := falconsense
-SOURCES  := falconsense.C ../utgcns/stashContains.C
+SOURCES  := falconsense.C correctionLayout.C ../utgcns/stashContains.C
 
 SRC_INCDIRS  := .. ../AS_UTL ../stores ../utgcns
 
@@ -8,7 +8,7 @@ ifeq "$(strip ${TARGET_DIR})" ""
 endif
 
 TARGET   := generateCorrectionLayouts
-SOURCES  := generateCorrectionLayouts.C ../utgcns/stashContains.C ../falcon_sense/outputFalcon.C
+SOURCES  := generateCorrectionLayouts.C correctionLayout.C ../utgcns/stashContains.C ../falcon_sense/outputFalcon.C
 
 SRC_INCDIRS  := .. ../AS_UTL ../stores ../utgcns ../falcon_sense ../falcon_sense/libfalcon
 
@@ -47,6 +47,7 @@ SOURCES      := AS_global.C \
                 AS_UTL/sweatShop.C \
                 AS_UTL/timeAndSize.C \
                 AS_UTL/kMer.C \
+                AS_UTL/lineBlockReader.C \
                 \
                 falcon_sense/libfalcon/falcon.C \
                 correction/computeGlobalScore.C \
@@ -61,6 +62,7 @@ SOURCES      := AS_global.C \
                 stores/gkStorePartition.C \
                 \
                 stores/ovOverlap.C \
+                stores/ovOverlapImport.C \
                 stores/ovStore.C \
                 stores/ovStoreWriter.C \
                 stores/ovStoreFilter.C \
@@ -92,6 +94,7 @@ SOURCES      := AS_global.C \
                 overlapInCore/liboverlap/prefixEditDistance-reverse.C \
                 \
                 overlapInCore/libedlib/edlib.C \
+                overlapInCore/libedlib/edlibBatch.C \
                 \
                 utgcns/libNDalign/NDalign.C \
                 \
@@ -205,11 +208,13 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 overlapInCore/overlapConvert.mk \
                 overlapInCore/overlapImport.mk \
                 overlapInCore/overlapPair.mk \
+                overlapInCore/overlapMinimizer.mk \
                 overlapInCore/edalign.mk \
                 \
                 overlapInCore/liboverlap/prefixEditDistance-matchLimitGenerate.mk \
                 \
                 mhap/mhapConvert.mk \
+                mhap/mhapNative.mk \
                 \
                 minimap/mmapConvert.mk \
                 \
@@ -684,6 +684,7 @@ sub setOverlapDefaults ($$$) {
     setOverlapDefault($tag, "OvlRefBlockLength",   undef,                     "Amount of sequence (bp) to search against the hash table per batch");
     setOverlapDefault($tag, "OvlHashBits",         ($tag eq "cor") ? 18 : 23, "Width of the kmer hash.  Width 22=1gb, 23=2gb, 24=4gb, 25=8gb.  Plus 10b per ${tag}OvlHashBlockLength");
     setOverlapDefault($tag, "OvlHashLoad",         0.75,                      "Maximum hash table load.  If set too high, table lookups are inefficent; if too low, search overhead dominates run time; default 0.75");
+    setOverlapDefault($tag, "OvlPlanPartition",    0,                         "Size hash blocks from the read lengths to fit in ${tag}OvlMemory, and balance work over jobs: 'true' or 'false'");
     setOverlapDefault($tag, "OvlMerSize",          ($tag eq "cor") ? 19 : 22, "K-mer size for seeds in overlaps");
     setOverlapDefault($tag, "OvlMerThreshold",     "auto",                    "K-mer frequency threshold; mers more frequent than this count are ignored; default 'auto'");
     setOverlapDefault($tag, "OvlMerDistinct",      undef,                     "K-mer frequency threshold; the least frequent fraction of distinct mers can seed overlaps");
@@ -880,6 +881,7 @@ sub setDefaults () {
     setDefault("obtErrorRate",       undef, "Stringency of overlaps to use for trimming");
     setDefault("trimReadsOverlap",   1,     "Minimum overlap between evidence to make contiguous trim; default '1'");
     setDefault("trimReadsCoverage",  1,     "Minimum depth of evidence to retain bases; default '1'");
+    setDefault("trimReadsThreads",   undef, "Number of threads for trimReads and splitReads, which run in the canu process; default all CPUs if local, 1 on a grid");
 
     #$global{"splitReads..."}               = 1;
     #$synops{"splitReads..."}               = "";
@@ -53,6 +53,25 @@ use canu::Report;
 use canu::Grid_Cloud;
 
 
+#  trimReads and splitReads run in the canu process, not as jobs, so there is no job
+#  configuration to size them.  Locally, use the whole machine (or maxThreads); on a grid,
+#  we don't know what the canu process was given, so use one thread unless told otherwise.
+
+sub getTrimThreads () {
+    my $thr = getGlobal("trimReadsThreads");
+
+    return($thr)  if (defined($thr));
+
+    return(1)     if ((getGlobal("useGrid") ne "0") && (defined(getGlobal("gridEngine"))));
+
+    $thr = getNumberOfCPUs();
+    $thr = getGlobal("maxThreads")  if ((defined(getGlobal("maxThreads"))) && (getGlobal("maxThreads") < $thr));
+
+    return($thr);
+}
+
+
+
 sub trimReads ($) {
     my $asm    = shift @_;
     my $bin    = getBinDirectory();
@@ -78,6 +97,7 @@ sub trimReads ($) {
     #$cmd .= "  -Cm ./$asm.max.clear \\\n"          if (-e "./$asm.max.clear");
     $cmd .= "  -ol " . getGlobal("trimReadsOverlap") . " \\\n";
     $cmd .= "  -oc " . getGlobal("trimReadsCoverage") . " \\\n";
+    $cmd .= "  -threads " . getTrimThreads() . " \\\n";
     $cmd .= "  -o  ./$asm.1.trimReads \\\n";
     $cmd .= ">     ./$asm.1.trimReads.err 2>&1";
 
@@ -149,6 +169,7 @@ sub splitReads ($) {
     $cmd .= "  -Co ./$asm.2.splitReads.clear \\\n";
     $cmd .= "  -e  $erate \\\n";
     $cmd .= "  -minlength " . getGlobal("minReadLength") . " \\\n";
+    $cmd .= "  -threads " . getTrimThreads() . " \\\n";
     $cmd .= "  -o  ./$asm.2.splitReads \\\n";
     $cmd .= ">     ./$asm.2.splitReads.err 2>&1";
 
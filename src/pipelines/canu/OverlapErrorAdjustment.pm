@@ -178,7 +178,10 @@ sub readErrorDetectionConfigure ($) {
         #
         #  Per base/vote:
         #    1 byte  for sequence
-        #   12 bytes for Vote_Tally_t
+        #    1 byte  for Vote_Base_t
+        #    4 bytes for Vote_Table_t - each disagreeing base needs 9 bytes of votes and an
+        #            8 byte key, in a hash table that is between 3/8 and 3/4 full.  Typically
+        #            5% to 10% of bases have disagreeing votes.
         #
         #  Per read:
         #   32 bytes for Frag_Info_t
@@ -194,7 +197,7 @@ sub readErrorDetectionConfigure ($) {
         #
         #  Throw in another 2 GB for unknown overheads (gkpStore, ovlStore) and alignment generation.
 
-        my $memory = (12 * $bases) + (33 * $reads) + (12 * $olaps) + (2 * $maxBlockSize) + 2 * 1024 * 1024 * 1024;
+        my $memory = (6 * $bases) + (33 * $reads) + (12 * $olaps) + (2 * $maxBlockSize) + 2 * 1024 * 1024 * 1024;
 
         if ((($maxMem   > 0) && ($memory >= $maxMem))    ||
             (($maxReads > 0) && ($reads  >= $maxReads))  ||
@@ -207,7 +210,7 @@ sub readErrorDetectionConfigure ($) {
                    $memory / 1024 / 1024,
                    $bgn[$nj], $end[$nj],
                    $reads,
-                   $bases,               (12 * $bases + 33 * $reads)  / 1024 / 1024,
+                   $bases,               (6 * $bases + 33 * $reads)   / 1024 / 1024,
                    $olaps,               (12 * $olaps)                / 1024 / 1024,
                    2 * $maxBlockSize / 1024 / 1024);
 
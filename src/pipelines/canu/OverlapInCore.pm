@@ -114,6 +114,15 @@ sub overlapConfigure ($$$) {
         $cmd .= " -hl " . getGlobal("${tag}OvlHashBlockLength") . " \\\n";
         $cmd .= " -rl " . getGlobal("${tag}OvlRefBlockLength")  . " \\\n";
         $cmd .= " -ol " . getGlobal("minOverlapLength") . " \\\n";
+
+        if (getGlobal("${tag}OvlPlanPartition") eq "1") {
+            $cmd .= " -M  " . getGlobal("${tag}OvlMemory") . " \\\n";
+            $cmd .= " -t  " . getGlobal("${tag}OvlThreads") . " \\\n";
+            $cmd .= " -hb " . getGlobal("${tag}OvlHashBits") . " \\\n";
+            $cmd .= " -hload " . getGlobal("${tag}OvlHashLoad") . " \\\n";
+            $cmd .= " -k  " . getGlobal("${tag}OvlMerSize") . " \\\n";
+        }
+
         $cmd .= " -o  ./$asm.partition \\\n";
         $cmd .= "> ./$asm.partition.err 2>&1";
 
@@ -273,6 +282,10 @@ sub reportOverlapStats ($$@) {
     my @dovetailOlaps;
     my @shortReject;
     my @longReject;
+    my @hashLoads;
+    my @plannedMemory;
+    my @peakMemory;
+    my @cpuTime;
 
     foreach my $s (@statsJobs) {
         fetchFile("$base/$s");
@@ -288,6 +301,15 @@ sub reportOverlapStats ($$@) {
         $_ = <F>;  push @shortReject, $1       if (m/^\s*Rejected\sby\sshort\swindow\s=\s(\d+)$/);
         $_ = <F>;  push @longReject, $1        if (m/^\s*Rejected\sby\slong\swindow\s=\s(\d+)$/);
 
+        #  Job cost, only in newer outputs.
+
+        while (<F>) {
+            push @hashLoads, $1                if (m/^\s*Hash\stable\sloads\s=\s(\d+)$/);
+            push @plannedMemory, $1            if (m/^\s*Planned\smemory\s\(MB\)\s=\s(\d+)$/);
+            push @peakMemory, $1               if (m/^\s*Peak\smemory\s\(MB\)\s=\s(\d+)$/);
+            push @cpuTime, $1                  if (m/^\s*CPU\sseconds\s=\s(\d+)$/);
+        }
+
         close(F);
     }
 
@@ -305,6 +327,21 @@ sub reportOverlapStats ($$@) {
     printf STDERR "--     multiple per pair   %12d  %s\n", reportSumMeanStdDev(@multiOlaps);
     printf STDERR "--     bad short window    %12d  %s\n", reportSumMeanStdDev(@shortReject);
     printf STDERR "--     bad long window     %12d  %s\n", reportSumMeanStdDev(@longReject);
+
+    if (scalar(@peakMemory) > 0) {
+        my $reloaded = 0;
+
+        foreach my $l (@hashLoads) {
+            $reloaded++  if ($l > 1);
+        }
+
+        printf STDERR "--\n";
+        printf STDERR "--   job cost (%d jobs needed more than one hash table load)\n", $reloaded;
+        printf STDERR "--     hash table loads    %12d  %s\n", reportSumMeanStdDev(@hashLoads);
+        printf STDERR "--     planned memory (MB) %12d  %s\n", reportSumMeanStdDev(@plannedMemory)  if (scalar(@plannedMemory) > 0);
+        printf STDERR "--     peak memory (MB)    %12d  %s\n", reportSumMeanStdDev(@peakMemory);
+        printf STDERR "--     cpu seconds         %12d  %s\n", reportSumMeanStdDev(@cpuTime);
+    }
 }
 
 